@@ -0,0 +1,249 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "clockrenderer.h"
+#include "textlayout.h"
+
+/*********************************************/
+/**************** Shader code ****************/
+/*********************************************/
+const char* vertShader = "\
+#version 330 core\n\
+layout (location = 0) in vec4 vertex; \
+out vec2 TexCoords;\
+uniform mat4 projection;\
+void main()\
+{\
+    gl_Position = projection * vec4(vertex.xy, 0.0, 1.0);\
+    TexCoords = vertex.zw;\
+}";
+
+const char* fragShader = "\
+#version 330 core\n\
+in vec2 TexCoords;\
+uniform sampler2D text;\
+void main()\
+{\
+    gl_FragColor = vec4(1.0, 1.0, 1.0, texture2D(text, TexCoords).r);\
+}";
+/*********************************************/
+
+// scratch buffer for laying out a single string
+static float textVertices[ClockRenderer::MAX_GLYPHS * 6][4];
+
+ClockRenderer::ClockRenderer()
+    : VBO(-1)
+    , VAO(-1)
+    , shaderProgram(-1)
+    , tableVBO(-1)
+    , tableVAO(-1)
+{
+}
+
+void ClockRenderer::createSharedResources()
+{
+    // compile shaders and link program
+    GLuint vertId, fragId;
+    vertId = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertId, 1, &vertShader, 0);
+    glCompileShader(vertId);
+
+    fragId = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragId, 1, &fragShader, 0);
+    glCompileShader(fragId);
+
+    shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vertId);
+    glAttachShader(shaderProgram, fragId);
+    glLinkProgram(shaderProgram);
+
+    glDeleteShader(vertId);
+    glDeleteShader(fragId);
+
+    // generate ortho projection matrix
+    float FarZ = 1000.f;
+    float NearZ = 0.1f;
+    float ReciprocalWidth = 1.0f / WIDTH;
+    float ReciprocalHeight = 1.0f / HEIGHT;
+    float fRange = 1.0f / (FarZ - NearZ);
+    float proj[4][4];
+    proj[0][0] = ReciprocalWidth + ReciprocalWidth;
+    proj[0][1] = 0.0f;
+    proj[0][2] = 0.0f;
+    proj[0][3] = 0.0f;
+    proj[1][0] = 0.0f;
+    proj[1][1] = ReciprocalHeight + ReciprocalHeight;
+    proj[1][2] = 0.0f;
+    proj[1][3] = 0.0f;
+    proj[2][0] = 0.0f;
+    proj[2][1] = 0.0f;
+    proj[2][2] = fRange;
+    proj[2][3] = 0.0f;
+    proj[3][0] = -1;
+    proj[3][1] = -1;
+    proj[3][2] = -fRange * NearZ;
+    proj[3][3] = 1.0f;
+
+    // set projection uniform
+    glUseProgram(shaderProgram);
+    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, &proj[0][0]);
+
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, STREAM_BUFFER_SIZE, NULL, GL_DYNAMIC_DRAW);
+}
+
+void ClockRenderer::initializeContext()
+{
+    glEnable(GL_TEXTURE_2D);
+    glEnable(GL_CULL_FACE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void ClockRenderer::drawText(const char* text, int posx, int posy, const FontAtlas& font, float scale)
+{
+    const int numGlyphs = layoutText(text, posx, posy, font, scale, textVertices, MAX_GLYPHS);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(VAO);
+
+    glBindTexture(GL_TEXTURE_2D, font.getGLTexture());
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+    // copy glyph vertices into VBO
+    glBufferSubData(GL_ARRAY_BUFFER, 0, numGlyphs * sizeof(textVertices[0]) * 6, textVertices);
+
+    // render text
+    glDrawArrays(GL_TRIANGLES, 0, numGlyphs * 6);
+
+    // unbind resources
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+bool ClockRenderer::drawFromMeshTable(const char* time, const char* date, int minuteOfDay, const FontAtlas& font, float scale)
+{
+    // fall back to streaming if the time string is not the one the table was built
+    // with (e.g. the locale changed) or the window uses a scale without a table
+    MeshTable* table = meshTableIndex.lookup(time, minuteOfDay, scale);
+    if (!table)
+        return false;
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(tableVAO);
+    glBindTexture(GL_TEXTURE_2D, font.getGLTexture());
+
+    // the date only changes once a day, upload its mesh when it does
+    if (table->dateText != date)
+    {
+        const int numGlyphs = layoutText(date, WIDTH - 10, HEIGHT / 2 - (font.getGlyphHeight() + 2) * scale,
+            font, scale, textVertices, DATE_GLYPHS);
+
+        glBindBuffer(GL_ARRAY_BUFFER, tableVBO);
+        glBufferSubData(GL_ARRAY_BUFFER, table->date.first * sizeof(textVertices[0]),
+            numGlyphs * sizeof(textVertices[0]) * 6, textVertices);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        table->date.count = numGlyphs * 6;
+        table->dateText = date;
+    }
+
+    // render time and date with a single draw call
+    const MeshRange& timeRange = table->times[minuteOfDay];
+    GLint first[2] = { timeRange.first, table->date.first };
+    GLsizei count[2] = { timeRange.count, table->date.count };
+    glMultiDrawArrays(GL_TRIANGLES, first, count, 2);
+
+    // unbind resources
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return true;
+}
+
+size_t ClockRenderer::buildMeshTable(const std::vector<std::string>& times, const std::vector<float>& scales, const FontAtlas& font)
+{
+    std::vector<float> vertexData;
+    meshTableIndex.reset(times);
+
+    for (auto scale : scales)
+    {
+        // windows sharing a scale share a table
+        if (!meshTableIndex.find(scale))
+            meshTableIndex.addTable(scale, font, WIDTH - 10, HEIGHT / 2, DATE_GLYPHS, vertexData);
+    }
+
+    // drop the table of a previous build
+    if (tableVBO != (GLuint)-1)
+    {
+        glDeleteVertexArrays(1, &tableVAO);
+        glDeleteBuffers(1, &tableVBO);
+    }
+
+    const size_t bufferSize = vertexData.size() * sizeof(float);
+
+    glGenVertexArrays(1, &tableVAO);
+    glGenBuffers(1, &tableVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, tableVBO);
+    glBufferData(GL_ARRAY_BUFFER, bufferSize, vertexData.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return bufferSize;
+}
+
+void ClockRenderer::initializeMeshTableContext()
+{
+    glBindVertexArray(tableVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, tableVBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void ClockRenderer::render(const char* time, const char* date, const FontAtlas& font, float scale, int minuteOfDay)
+{
+    // render
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(shaderProgram);
+    if (!drawFromMeshTable(time, date, minuteOfDay, font, scale))
+    {
+        drawText(time, WIDTH - 10, HEIGHT / 2, font, scale);
+        drawText(date, WIDTH - 10, HEIGHT / 2 - (font.getGlyphHeight() + 2) * scale, font, scale);
+    }
+
+    glFlush();
+}
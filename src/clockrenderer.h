@@ -0,0 +1,71 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#pragma once
+
+#include "fontatlas.h"
+#include "meshtable.h"
+
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+
+// draws time and date into the current GL context. contexts share their resources,
+// so the shared ones are created once and every context sets up its vertex arrays
+class ClockRenderer
+{
+public:
+    static const int WIDTH = 120, HEIGHT = 50;
+    static const int MAX_GLYPHS = 100;
+    static const size_t STREAM_BUFFER_SIZE = sizeof(float) * 6 * 4 * MAX_GLYPHS;
+
+    ClockRenderer();
+
+    // creates the shader and the streaming buffer, call in the main context
+    void createSharedResources();
+    // sets up the current context, call once per context after createSharedResources
+    void initializeContext();
+
+    void render(const char* time, const char* date, const FontAtlas& font, float scale, int minuteOfDay = -1);
+
+    // lays out every time string of the day (indexed by minute of day) once for each
+    // scale and uploads them into the mesh table VBO, call in the main context.
+    // replaces the table of a previous call, returns the size of the VBO in bytes
+    size_t buildMeshTable(const std::vector<std::string>& times, const std::vector<float>& scales, const FontAtlas& font);
+    // sets up the current context for the mesh table, call once per context after buildMeshTable
+    void initializeMeshTableContext();
+
+    // whether time at minuteOfDay can be rendered from the mesh table at scale
+    bool isMeshTableCurrent(const char* time, int minuteOfDay, float scale) { return meshTableIndex.lookup(time, minuteOfDay, scale) != NULL; }
+
+private:
+    // glyphs reserved per scale for the date mesh in the mesh table
+    static const int DATE_GLYPHS = 32;
+
+    GLuint VBO, VAO, shaderProgram;
+    GLuint tableVBO, tableVAO;
+    MeshTableIndex meshTableIndex;
+
+    void drawText(const char* text, int posx, int posy, const FontAtlas& font, float scale);
+    bool drawFromMeshTable(const char* time, const char* date, int minuteOfDay, const FontAtlas& font, float scale);
+};
@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "clockticker.h"
+
+ClockTicker::ClockTicker(ClockSource& source)
+    : source(source)
+    , lastUpdate()
+    , timeBuffer()
+    , dateBuffer()
+{
+}
+
+bool ClockTicker::update()
+{
+    ClockTime t = source.getLocalTime();
+
+    // only render the clocks every new minute. compare the full date as well, so that a
+    // clock change or resume landing on the same minute whole hours or days later updates
+    if (t.minute == lastUpdate.minute && t.hour == lastUpdate.hour &&
+        t.day == lastUpdate.day && t.month == lastUpdate.month && t.year == lastUpdate.year)
+        return false;
+
+    lastUpdate = t;
+
+    source.formatTime(t, timeBuffer, sizeof(timeBuffer));
+    source.formatDate(t, dateBuffer, sizeof(dateBuffer));
+
+    return true;
+}
+
+std::vector<std::string> ClockTicker::formatTimesOfDay()
+{
+    std::vector<std::string> times;
+    char buffer[32];
+
+    ClockTime t = source.getLocalTime();
+    for (int minute = 0; minute < 24 * 60; minute++)
+    {
+        t.hour = minute / 60;
+        t.minute = minute % 60;
+        source.formatTime(t, buffer, sizeof(buffer));
+        times.push_back(buffer);
+    }
+
+    return times;
+}
@@ -0,0 +1,70 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// broken down local time, holds the fields of SYSTEMTIME the clock uses
+struct ClockTime
+{
+    int year, month, dayOfWeek, day, hour, minute, second;
+};
+
+// provides the local time and formats it according to the user's locale
+class ClockSource
+{
+public:
+    virtual ~ClockSource() {}
+
+    virtual ClockTime getLocalTime() = 0;
+    virtual void formatTime(const ClockTime& time, char* buffer, int size) = 0;
+    virtual void formatDate(const ClockTime& time, char* buffer, int size) = 0;
+};
+
+// decides when the clocks need to be rendered and formats what they show
+class ClockTicker
+{
+public:
+    ClockTicker(ClockSource& source);
+
+    // polls the clock source, returns true once for every new minute
+    bool update();
+
+    // formats the time of every minute of the current day, indexed by minute of day
+    std::vector<std::string> formatTimesOfDay();
+
+    const char* getTime() const { return timeBuffer; }
+    const char* getDate() const { return dateBuffer; }
+    const int getMinuteOfDay() const { return lastUpdate.hour * 60 + lastUpdate.minute; }
+
+private:
+    ClockTicker(const ClockTicker&);
+
+    ClockSource& source;
+    ClockTime lastUpdate;
+
+    char timeBuffer[32];
+    char dateBuffer[32];
+};
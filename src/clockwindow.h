@@ -24,6 +24,10 @@ freely, subject to the following restrictions:
 #pragma once
 
 #include "fontbitmap.h"
+#include "clockrenderer.h"
+
+#include <string>
+#include <vector>
 
 #include <GLFW/glfw3.h>
 #define GLFW_EXPOSE_NATIVE_WIN32
@@ -32,13 +36,11 @@ freely, subject to the following restrictions:
 class ClockWindow
 {
 private:
-	const int WIDTH = 120, HEIGHT = 50;
+	static const int WIDTH = ClockRenderer::WIDTH, HEIGHT = ClockRenderer::HEIGHT;
 	static GLFWwindow* mainWindow;
-	static GLuint VBO, VAO, shaderProgram;
+	static ClockRenderer renderer;
 	GLFWwindow* window;
 
-	void drawText(const char* text, int posx, int posy, const FontBitmap& font, float scale);
-	void getTextExtent(const char* text, const FontBitmap& font, int* width, int* height);
 	static void popupMenu(GLFWwindow* window, int button, int action, int mods);
 
 public:
@@ -47,7 +49,14 @@ public:
 	ClockWindow(int monitorIdx);
 
 	void initializeGLResources();
-	void render(const char* time, const char* date, const FontBitmap& font);
+	void render(const char* time, const char* date, const FontBitmap& font, int minuteOfDay = -1);
+
+	// lays out every time string of the day (indexed by minute of day) once for each
+	// content scale in use, so that render only has to issue a draw call.
+	// returns the size of the created vertex buffer in bytes
+	static size_t buildMeshTable(const std::vector<ClockWindow*>& windows, const std::vector<std::string>& times, const FontBitmap& font);
+	// whether every window can render time from the mesh table
+	static bool isMeshTableCurrent(const std::vector<ClockWindow*>& windows, const char* time, int minuteOfDay);
 
 	GLFWwindow* getWindow() const { return window; }
 	HWND getHWND() const { return glfwGetWin32Window(window); }
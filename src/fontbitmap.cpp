@@ -27,8 +27,6 @@ freely, subject to the following restrictions:
 #include <math.h>
 
 FontBitmap::FontBitmap()
-    : glyphHeight(0)
-    , glyphWidth(0)
 {
 }
 
@@ -167,9 +165,3 @@ FontBitmap::~FontBitmap()
 {
     if (texture) glDeleteTextures(1, &texture);
 }
-
-const Glyph& FontBitmap::getGlyph(char c) const
-{
-    c = (c < LOCHAR || c > HICHAR) ? '?' : c;
-    return glyphs[c - LOCHAR];
-}
@@ -23,22 +23,12 @@ freely, subject to the following restrictions:
 
 #pragma once
 
-#include <stdint.h>
-
-#define LOCHAR ' '
-#define HICHAR '~'
-#define NUMCHARS (HICHAR - LOCHAR + 1)
+#include "fontatlas.h"
 
 #define FBM_BOLD 1
 #define FBM_ITALIC 2
 
-struct Glyph
-{
-    float u, v;
-    int8_t charWidth, charHeight, advance, xoff, yoff;
-};
-
-class FontBitmap
+class FontBitmap : public FontAtlas
 {
 public:
     FontBitmap();
@@ -46,25 +36,6 @@ public:
 
     void create(const char* fontName, int fontSize, int flags);
 
-    const Glyph& getGlyph(char c) const;
-    const int getFontHeight() const { return fontHeight; }
-    const int getFontHeightAboveBaseline() const { return fontHeight - fontDescent; }
-    const int getFontAscent() const { return fontAscent; }
-    const int getFontDescent() const { return fontDescent; }
-    const int getTextureWidth() const { return textureWidth; }
-    const int getGlyphWidth() const { return glyphWidth; }
-    const int getGlyphHeight() const { return glyphHeight; }
-    const float getUW() const { return glyphWidth / (float)textureWidth; }
-    const float getVH() const { return glyphHeight / (float)textureWidth; }
-
-    const unsigned int getGLTexture() const { return texture; }
-
 private:
     FontBitmap(const FontBitmap&);
-
-    Glyph glyphs[NUMCHARS];
-
-    unsigned int texture;
-
-    int fontHeight, fontAscent, fontDescent, textureWidth, glyphWidth, glyphHeight;
 };
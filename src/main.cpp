@@ -25,20 +25,100 @@ freely, subject to the following restrictions:
 #include <vector>
 #include <windows.h>
 #include <ctime>
+#include <string>
+#include <cstdio>
 
 #include "fontbitmap.h"
 #include "clockwindow.h"
+#include "clockticker.h"
 
 #include <GLFW/glfw3.h>
 
+// system clock, formatted with the user's locale settings
+class Win32ClockSource : public ClockSource
+{
+public:
+    ClockTime getLocalTime() override
+    {
+        SYSTEMTIME t;
+        GetLocalTime(&t);
+        return { t.wYear, t.wMonth, t.wDayOfWeek, t.wDay, t.wHour, t.wMinute, t.wSecond };
+    }
+
+    void formatTime(const ClockTime& time, char* buffer, int size) override
+    {
+        SYSTEMTIME t = toSystemTime(time);
+        GetTimeFormatA(LOCALE_USER_DEFAULT, TIME_NOSECONDS, &t, NULL, buffer, size);
+    }
+
+    void formatDate(const ClockTime& time, char* buffer, int size) override
+    {
+        SYSTEMTIME t = toSystemTime(time);
+        GetDateFormatA(LOCALE_USER_DEFAULT, 0, &t, NULL, buffer, size);
+    }
+
+private:
+    static SYSTEMTIME toSystemTime(const ClockTime& time)
+    {
+        SYSTEMTIME t = {};
+        t.wYear = time.year;
+        t.wMonth = time.month;
+        t.wDayOfWeek = time.dayOfWeek;
+        t.wDay = time.day;
+        t.wHour = time.hour;
+        t.wMinute = time.minute;
+        t.wSecond = time.second;
+        return t;
+    }
+};
+
+// lays out the meshes of all time strings of the current day and reports the build
+// time and memory against minute updates along the streaming path
+static void buildMeshTable(const std::vector<ClockWindow*>& clockWindows, ClockTicker& ticker, const FontBitmap& font)
+{
+    LARGE_INTEGER freq, start, end;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&start);
+
+    size_t tableSize = ClockWindow::buildMeshTable(clockWindows, ticker.formatTimesOfDay(), font);
+
+    QueryPerformanceCounter(&end);
+    const double buildMs = (end.QuadPart - start.QuadPart) * 1000.0 / freq.QuadPart;
+
+    // time minute updates of the first clock along both paths. the first table
+    // render uploads the date, which only happens once a day
+    const int runs = 100;
+    ClockWindow* window = clockWindows.front();
+    window->render(ticker.getTime(), ticker.getDate(), font, ticker.getMinuteOfDay());
+
+    QueryPerformanceCounter(&start);
+    for (int i = 0; i < runs; i++)
+        window->render(ticker.getTime(), ticker.getDate(), font);
+    QueryPerformanceCounter(&end);
+    const double streamingUs = (end.QuadPart - start.QuadPart) * 1000000.0 / freq.QuadPart / runs;
+
+    QueryPerformanceCounter(&start);
+    for (int i = 0; i < runs; i++)
+        window->render(ticker.getTime(), ticker.getDate(), font, ticker.getMinuteOfDay());
+    QueryPerformanceCounter(&end);
+    const double tableUs = (end.QuadPart - start.QuadPart) * 1000000.0 / freq.QuadPart / runs;
+
+    // each glyph is uploaded as six vertices of four floats
+    const size_t streamedBytes = (strlen(ticker.getTime()) + strlen(ticker.getDate())) * 6 * 4 * sizeof(float);
+
+    char report[256];
+    snprintf(report, sizeof(report),
+        "mesh table: built in %.2f ms, %zu bytes\n"
+        "minute update: streaming %.1f us, %zu bytes uploaded into a %zu byte buffer; mesh table %.1f us, 0 bytes uploaded\n",
+        buildMs, tableSize, streamingUs, streamedBytes, ClockRenderer::STREAM_BUFFER_SIZE, tableUs);
+    OutputDebugStringA(report);
+}
 
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine, int nCmdShow)
 {
     std::vector<ClockWindow*> clockWindows;
-    char timeBuffer[32];
-    char dateBuffer[32];
-    SYSTEMTIME t;
-    WORD minuteLastUpdate = -1;
+    Win32ClockSource clockSource;
+    ClockTicker ticker(clockSource);
 
     if (!glfwInit())
         return -1;
@@ -73,22 +153,21 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
     for (auto window : clockWindows)
         window->initializeGLResources();
 
+    // --mesh-table precomputes the meshes of all time strings of the day
+    const bool useMeshTable = pCmdLine && wcsstr(pCmdLine, L"--mesh-table");
+
     // Loop until the user closes the window
     for(;;)
     {
-        GetLocalTime(&t);
-
         // only render the clocks every new minute
-        if (t.wMinute != minuteLastUpdate)
+        if (ticker.update())
         {
-            minuteLastUpdate = t.wMinute;
-
-            // use local time and date format settings
-            GetTimeFormatA(LOCALE_USER_DEFAULT, TIME_NOSECONDS, &t, NULL, timeBuffer, sizeof(timeBuffer));
-            GetDateFormatA(LOCALE_USER_DEFAULT, 0, &t, NULL, dateBuffer, sizeof(dateBuffer));
+            // (re)build the mesh table lazily, e.g. after the locale or a window's scale changed
+            if (useMeshTable && !ClockWindow::isMeshTableCurrent(clockWindows, ticker.getTime(), ticker.getMinuteOfDay()))
+                buildMeshTable(clockWindows, ticker, font);
 
             for (auto window : clockWindows)
-                window->render(timeBuffer, dateBuffer, font);
+                window->render(ticker.getTime(), ticker.getDate(), font, ticker.getMinuteOfDay());
         }
 
         for (auto window : clockWindows)
@@ -0,0 +1,78 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "meshtable.h"
+#include "textlayout.h"
+
+#include <algorithm>
+
+MeshTableIndex::MeshTableIndex()
+    : vertexCount(0)
+{
+}
+
+void MeshTableIndex::reset(const std::vector<std::string>& times)
+{
+    this->times = times;
+    tables.clear();
+    vertexCount = 0;
+}
+
+void MeshTableIndex::addTable(float scale, const FontAtlas& font, int posx, int posy, int dateGlyphs, std::vector<float>& vertexData)
+{
+    MeshTable table;
+    table.scale = scale;
+
+    for (auto& time : times)
+    {
+        // lay out straight into the buffer, each glyph is a quad made of two triangles
+        vertexData.resize((vertexCount + time.size() * 6) * 4);
+        const int numGlyphs = layoutText(time.c_str(), posx, posy, font, scale,
+            (float (*)[4])&vertexData[vertexCount * 4], (int)time.size());
+
+        table.times.push_back({ vertexCount, numGlyphs * 6 });
+        vertexCount += numGlyphs * 6;
+    }
+
+    // the date is uploaded once it is known
+    table.date = { vertexCount, 0 };
+    vertexCount += dateGlyphs * 6;
+    vertexData.resize(vertexCount * 4, 0.f);
+
+    tables.push_back(table);
+}
+
+MeshTable* MeshTableIndex::find(float scale)
+{
+    auto table = std::find_if(tables.begin(), tables.end(),
+        [scale](const MeshTable& t) { return t.scale == scale; });
+    return table != tables.end() ? &*table : NULL;
+}
+
+MeshTable* MeshTableIndex::lookup(const char* time, int minuteOfDay, float scale)
+{
+    if (minuteOfDay < 0 || minuteOfDay >= (int)times.size() || times[minuteOfDay] != time)
+        return NULL;
+
+    return find(scale);
+}
@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#pragma once
+
+#include "fontatlas.h"
+
+#include <string>
+#include <vector>
+
+// vertex range of a laid out string inside the mesh table VBO
+struct MeshRange
+{
+    int first;
+    int count;
+};
+
+// precomputed meshes of all time strings for one content scale
+struct MeshTable
+{
+    float scale;
+    std::vector<MeshRange> times;
+    MeshRange date;
+    std::string dateText;
+};
+
+// keeps track of where the meshes of each time string (indexed by minute of day)
+// are located in the mesh table VBO, without touching any GL state
+class MeshTableIndex
+{
+public:
+    MeshTableIndex();
+
+    // drops all tables and sets the time strings the tables are built from
+    void reset(const std::vector<std::string>& times);
+
+    // lays out all time strings at the given position and scale and appends them to
+    // vertexData, which holds the vertices (x, y, u, v) of the tables added before.
+    // an empty date slot of dateGlyphs glyphs follows the time meshes
+    void addTable(float scale, const FontAtlas& font, int posx, int posy, int dateGlyphs, std::vector<float>& vertexData);
+
+    MeshTable* find(float scale);
+
+    // returns the table to render time at minuteOfDay with, or NULL if the time string
+    // differs from the one the table was built with (e.g. after a locale change)
+    MeshTable* lookup(const char* time, int minuteOfDay, float scale);
+
+    const std::vector<std::string>& getTimes() const { return times; }
+    const int getVertexCount() const { return vertexCount; }
+
+private:
+    std::vector<std::string> times;
+    std::vector<MeshTable> tables;
+    int vertexCount;
+};
@@ -0,0 +1,79 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "textlayout.h"
+
+#include <string.h>
+
+int layoutText(const char* text, int posx, int posy, const FontAtlas& font, float scale, float (*vertices)[4], int maxGlyphs)
+{
+    const float w = font.getGlyphWidth() * scale;
+    const float h = font.getGlyphHeight() * scale;
+    const float uw = font.getUW();
+    const float vh = font.getVH();
+
+    int textExtentX, textExtentY;
+    getTextExtent(text, font, &textExtentX, &textExtentY);
+    // align right
+    int xoffset = -textExtentX;
+
+    int i = 0;
+    int currentStrWidth = 0;
+    for (; text[i] && i < maxGlyphs; i++)
+    {
+        const Glyph& glyph = font.getGlyph(text[i]);
+        const float u = glyph.u;
+        const float v = glyph.v;
+        const float x = posx + (currentStrWidth + xoffset + glyph.xoff) * scale;
+        const float y = posy - glyph.yoff * scale;
+        currentStrWidth += glyph.advance;
+
+        float glyphVertices[6][4]
+        {
+            { x,		y,		u, v + vh },
+            { x + w,	y,		u + uw, v + vh },
+            { x,		y + h,	u, v },
+            { x + w,	y,		u + uw, v + vh },
+            { x + w,	y + h,	u + uw, v },
+            { x,		y + h,	u, v }
+        };
+
+        memcpy(vertices + i * 6, glyphVertices, sizeof(glyphVertices));
+    }
+
+    return i;
+}
+
+void getTextExtent(const char* text, const FontAtlas& font, int* width, int* height)
+{
+    auto len = strlen(text);
+    int w = 0;
+    for (int i = 0; i < len-1; i++)
+        w += font.getGlyph(text[i]).advance;
+
+    // for last character, use character width instead of advance
+    w += font.getGlyph(text[len-1]).charWidth;
+
+    *width = w;
+    *height = font.getFontHeightAboveBaseline();
+}
@@ -0,0 +1,228 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "clockrenderer.h"
+#include "clockticker.h"
+#include "glstub.h"
+#include "testfont.h"
+#include "virtualclock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <string>
+#include <unistd.h>
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { if (!(cond)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// resident set size in bytes, 0 if /proc is not available
+static long long getResidentSize()
+{
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file)
+        return 0;
+
+    long long size = 0, resident = 0;
+    if (fscanf(file, "%lld %lld", &size, &resident) != 2)
+        resident = 0;
+    fclose(file);
+
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+// runs the main loop with --mesh-table from local midnight of new year 2026 to new
+// year 2027, in steps of 1 to 20 seconds. each window stands for a clock on its own
+// monitor and is given by its content scale. every minute update renders each window
+// along the mesh table path and, for comparison, along the streaming path
+static void testSoakYear()
+{
+    const int64_t start = daysFromCivil(2026, 1, 1) * DAY - HOUR;
+    const int64_t end = daysFromCivil(2027, 1, 1) * DAY - HOUR;
+    // events happen mid-minute, so they are picked up by the next minute update
+    const int64_t localeSwitch = daysFromCivil(2026, 6, 15) * DAY + 10 * HOUR + 30 * 1000;
+    const int64_t monitorPlugged = daysFromCivil(2026, 9, 1) * DAY + 8 * HOUR + 15 * 1000;
+    const int64_t monitorUnplugged = daysFromCivil(2026, 10, 1) * DAY + 8 * HOUR + 45 * 1000;
+    const int64_t scaleChange = daysFromCivil(2026, 11, 2) * DAY + 14 * HOUR + 20 * 1000;
+    // no events after this, memory has to stay flat
+    const int64_t leakCheckStart = daysFromCivil(2026, 11, 3) * DAY;
+
+    VirtualClock clock;
+    ClockTicker ticker(clock);
+    TestFont font;
+    ClockRenderer renderer;
+    std::vector<float> windows = { 1.f, 1.5f };
+    clock.utc = start;
+
+    // startup, the first window's context creates the shared resources
+    renderer.createSharedResources();
+    for (size_t i = 0; i < windows.size(); i++)
+        renderer.initializeContext();
+
+    // program, streaming VBO and VAO, plus the table VBO and VAO once built
+    const int tableObjects = glStubGetStats().liveObjects + 2;
+
+    bool plugged = false, unplugged = false, scaleChanged = false;
+    int frames = 0, rebuilds = 0;
+    long long minuteUpdates = 0, renders = 0, lastMinute = start / MINUTE - 1;
+    long long maxTableCalls = 0, maxStreamingCalls = 0;
+    long long rssFirstDay = 0, rssPeak = 0, rssLeakCheck = 0, rss = 0;
+    int64_t lastDay = start / DAY;
+    // date last uploaded into the table of each scale
+    std::map<float, std::string> uploadedDates;
+    std::vector<float> drawn;
+    uint32_t seed = 1;
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    while (clock.utc < end)
+    {
+        frames++;
+
+        if (!clock.twelveHour && clock.utc >= localeSwitch)
+            clock.twelveHour = true;
+
+        if (!plugged && clock.utc >= monitorPlugged)
+        {
+            windows.push_back(1.25f);
+            renderer.initializeContext();
+            plugged = true;
+        }
+
+        if (!unplugged && clock.utc >= monitorUnplugged)
+        {
+            windows.pop_back();
+            unplugged = true;
+        }
+
+        if (!scaleChanged && clock.utc >= scaleChange)
+        {
+            windows[1] = 1.75f;
+            scaleChanged = true;
+        }
+
+        if (ticker.update())
+        {
+            // exactly one update per minute, in order
+            minuteUpdates++;
+            CHECK(clock.utc / MINUTE == lastMinute + 1);
+            lastMinute = clock.utc / MINUTE;
+
+            bool current = true;
+            for (float scale : windows)
+                current = current && renderer.isMeshTableCurrent(ticker.getTime(), ticker.getMinuteOfDay(), scale);
+
+            if (!current)
+            {
+                rebuilds++;
+                renderer.buildMeshTable(ticker.formatTimesOfDay(), windows, font);
+                for (size_t i = 0; i < windows.size(); i++)
+                    renderer.initializeMeshTableContext();
+                uploadedDates.clear();
+
+                // the previous table is released
+                CHECK(glStubGetStats().liveObjects == tableObjects);
+            }
+
+            for (float scale : windows)
+            {
+                renders++;
+
+                GLStubStats before = glStubGetStats();
+                glStubClearDrawnVertices();
+                renderer.render(ticker.getTime(), ticker.getDate(), font, scale, ticker.getMinuteOfDay());
+                GLStubStats after = glStubGetStats();
+                drawn = glStubGetDrawnVertices();
+
+                // one draw call, buffer writes only for the first date of a table
+                const bool newDate = uploadedDates[scale] != ticker.getDate();
+                uploadedDates[scale] = ticker.getDate();
+                CHECK(after.drawCalls - before.drawCalls == 1);
+                CHECK(after.bufferWrites - before.bufferWrites == (newDate ? 1 : 0));
+                maxTableCalls = std::max(maxTableCalls, after.calls - before.calls);
+
+                // the streaming path draws the same vertices
+                before = after;
+                glStubClearDrawnVertices();
+                renderer.render(ticker.getTime(), ticker.getDate(), font, scale);
+                after = glStubGetStats();
+                CHECK(after.drawCalls - before.drawCalls == 2);
+                CHECK(after.bufferWrites - before.bufferWrites == 2);
+                CHECK(!drawn.empty() && glStubGetDrawnVertices() == drawn);
+                maxStreamingCalls = std::max(maxStreamingCalls, after.calls - before.calls);
+            }
+        }
+
+        // sample memory once per simulated day
+        if (clock.utc / DAY != lastDay)
+        {
+            lastDay = clock.utc / DAY;
+            rss = getResidentSize();
+            rssPeak = std::max(rssPeak, rss);
+            if (!rssFirstDay)
+                rssFirstDay = rss;
+            if (!rssLeakCheck && clock.utc >= leakCheckStart)
+                rssLeakCheck = rss;
+        }
+
+        seed = seed * 1664525 + 1013904223;
+        clock.utc += 1000 + (seed >> 16) % 19000;
+    }
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    printf("simulated 2026 in %.2f s (%.0fx real time), %d frames, %lld renders, %d table builds\n",
+        wallSeconds, (end - start) / 1000.0 / wallSeconds, frames, renders, rebuilds);
+    printf("max GL calls per render: %lld with mesh table, %lld streaming\n", maxTableCalls, maxStreamingCalls);
+    printf("RSS: %lld KiB after the first day, %lld KiB peak, %lld KiB at the end\n",
+        rssFirstDay / 1024, rssPeak / 1024, rss / 1024);
+
+    CHECK(minuteUpdates == 365 * 24 * 60);
+    // startup, locale switch, plugged monitor and scale change. unplugging needs none
+    CHECK(rebuilds == 4);
+
+    const GLStubStats stats = glStubGetStats();
+    CHECK(stats.errors == 0);
+    CHECK(stats.liveObjects == tableObjects);
+    CHECK(maxTableCalls <= 16);
+    CHECK(maxStreamingCalls <= 24);
+
+    if (rss)
+    {
+        CHECK(rssPeak <= rssFirstDay + 16 * 1024 * 1024);
+        CHECK(rss <= rssLeakCheck + 256 * 1024);
+    }
+    else
+        printf("/proc/self/statm not available, RSS not checked\n");
+}
+
+int main()
+{
+    testSoakYear();
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,148 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "clockticker.h"
+#include "virtualclock.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { if (!(cond)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// drives the ticker like the main loop does, from local midnight of new year 2026
+// to new year 2027 in steps of 100 to 1100 ms, and checks every render
+static void testSimulatedYear()
+{
+    const int64_t start = daysFromCivil(2026, 1, 1) * DAY - HOUR;
+    const int64_t end = daysFromCivil(2027, 1, 1) * DAY - HOUR;
+    // mid-minute, to check the switch doesn't cause an extra render
+    const int64_t localeSwitch = daysFromCivil(2026, 6, 15) * DAY + 10 * HOUR + 30 * 1000;
+
+    VirtualClock clock;
+    ClockTicker ticker(clock);
+    clock.utc = start;
+
+    int64_t renders = 0, lastRenderMinute = start / MINUTE - 1;
+    int lastMinuteOfDay = -1, springJumps = 0, autumnJumps = 0, dateChanges = 0, frames = 0;
+    char lastDate[32] = "";
+    uint32_t seed = 1;
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    while (clock.utc < end)
+    {
+        if (!clock.twelveHour && clock.utc >= localeSwitch)
+            clock.twelveHour = true;
+
+        frames++;
+        if (ticker.update())
+        {
+            renders++;
+
+            // exactly one render per minute, in order
+            const int64_t renderMinute = clock.utc / MINUTE;
+            CHECK(renderMinute == lastRenderMinute + 1);
+            lastRenderMinute = renderMinute;
+
+            // rendered strings reflect the current time and locale
+            const ClockTime t = clock.getLocalTime();
+            char expected[32];
+            clock.formatTime(t, expected, sizeof(expected));
+            CHECK(strcmp(ticker.getTime(), expected) == 0);
+            clock.formatDate(t, expected, sizeof(expected));
+            CHECK(strcmp(ticker.getDate(), expected) == 0);
+            CHECK(ticker.getMinuteOfDay() == t.hour * 60 + t.minute);
+
+            // local time skips or repeats an hour at the DST transitions
+            const int minuteOfDay = ticker.getMinuteOfDay();
+            if (lastMinuteOfDay >= 0 && minuteOfDay != (lastMinuteOfDay + 1) % (24 * 60))
+            {
+                if (lastMinuteOfDay == 1 * 60 + 59 && minuteOfDay == 3 * 60)
+                    springJumps++;
+                else if (lastMinuteOfDay == 2 * 60 + 59 && minuteOfDay == 2 * 60)
+                    autumnJumps++;
+                else
+                    CHECK(!"unexpected jump in local time");
+            }
+            lastMinuteOfDay = minuteOfDay;
+
+            if (strcmp(lastDate, ticker.getDate()) != 0)
+            {
+                dateChanges++;
+                strcpy(lastDate, ticker.getDate());
+            }
+        }
+
+        seed = seed * 1664525 + 1013904223;
+        clock.utc += 100 + (seed >> 16) % 1000;
+    }
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    printf("simulated 2026 in %.2f s (%.0fx real time), %d frames, %lld renders\n",
+        wallSeconds, (end - start) / 1000.0 / wallSeconds, frames, (long long)renders);
+
+    CHECK(renders == 365 * 24 * 60);
+    CHECK(springJumps == 1);
+    CHECK(autumnJumps == 1);
+    // one change per day and one for the locale switch
+    CHECK(dateChanges == 365 + 1);
+}
+
+// the clock is set or the machine resumes on the same minute value hours or days later
+static void testWholeHourJumps()
+{
+    VirtualClock clock;
+    ClockTicker ticker(clock);
+    clock.utc = daysFromCivil(2026, 3, 1) * DAY + 12 * HOUR;
+
+    CHECK(ticker.update());
+    CHECK(!ticker.update());
+
+    clock.utc += HOUR;
+    CHECK(ticker.update());
+    CHECK(strcmp(ticker.getTime(), "14:00") == 0);
+    CHECK(!ticker.update());
+
+    clock.utc -= 2 * HOUR;
+    CHECK(ticker.update());
+    CHECK(strcmp(ticker.getTime(), "12:00") == 0);
+
+    clock.utc += DAY;
+    CHECK(ticker.update());
+    CHECK(strcmp(ticker.getDate(), "02.03.2026") == 0);
+    CHECK(!ticker.update());
+}
+
+int main()
+{
+    testWholeHourJumps();
+    testSimulatedYear();
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "meshtable.h"
+#include "textlayout.h"
+#include "testfont.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { if (!(cond)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// time strings of every minute of the day, e.g. "9:05" or "9:05 AM"
+static std::vector<std::string> makeTimes(bool twelveHour)
+{
+    std::vector<std::string> times;
+    char buf[32];
+    for (int minute = 0; minute < 24 * 60; minute++)
+    {
+        const int hour = minute / 60;
+        if (twelveHour)
+            snprintf(buf, sizeof(buf), "%d:%02d %s", (hour + 11) % 12 + 1, minute % 60, hour < 12 ? "AM" : "PM");
+        else
+            snprintf(buf, sizeof(buf), "%d:%02d", hour, minute % 60);
+        times.push_back(buf);
+    }
+    return times;
+}
+
+static const int POSX = 110, POSY = 25, DATE_GLYPHS = 32;
+
+static void testRanges()
+{
+    TestFont font;
+    MeshTableIndex index;
+    std::vector<float> vertexData;
+    index.reset({ "0:00", "10:00", "0:02" });
+
+    index.addTable(1.f, font, POSX, POSY, DATE_GLYPHS, vertexData);
+    CHECK(index.getVertexCount() == (4 + 5 + 4 + 32) * 6);
+    CHECK(vertexData.size() == (size_t)index.getVertexCount() * 4);
+
+    MeshTable* table = index.find(1.f);
+    CHECK(table != NULL);
+    CHECK(table->times.size() == 3);
+    CHECK(table->times[0].first == 0 && table->times[0].count == 24);
+    CHECK(table->times[1].first == 24 && table->times[1].count == 30);
+    CHECK(table->times[2].first == 54 && table->times[2].count == 24);
+    // date slot follows the time meshes and is empty until the date is uploaded
+    CHECK(table->date.first == 78 && table->date.count == 0);
+
+    // second scale starts behind the date slot of the first
+    index.addTable(1.5f, font, POSX, POSY, DATE_GLYPHS, vertexData);
+    MeshTable* scaled = index.find(1.5f);
+    CHECK(scaled != NULL);
+    CHECK(scaled->times[0].first == (4 + 5 + 4 + 32) * 6);
+    CHECK(scaled->date.first == (4 + 5 + 4 + 32) * 6 + 78);
+    CHECK(index.getVertexCount() == 2 * (4 + 5 + 4 + 32) * 6);
+    CHECK(vertexData.size() == (size_t)index.getVertexCount() * 4);
+}
+
+// the table holds the same meshes the streaming path lays out
+static void testMeshesMatchLayout()
+{
+    const std::vector<std::string> times = makeTimes(true);
+    const float scales[] = { 1.f, 1.25f };
+    TestFont font;
+    MeshTableIndex index;
+    std::vector<float> vertexData;
+    index.reset(times);
+    for (float scale : scales)
+        index.addTable(scale, font, POSX, POSY, DATE_GLYPHS, vertexData);
+
+    CHECK(vertexData.size() == (size_t)index.getVertexCount() * 4);
+
+    float vertices[32 * 6][4];
+    for (float scale : scales)
+    {
+        MeshTable* table = index.find(scale);
+        CHECK(table != NULL);
+        CHECK(table->times.size() == 24 * 60);
+
+        for (int minute = 0; minute < 24 * 60; minute++)
+        {
+            const int numGlyphs = layoutText(times[minute].c_str(), POSX, POSY, font, scale, vertices, 32);
+            const MeshRange& range = table->times[minute];
+            CHECK(range.count == numGlyphs * 6);
+            CHECK(memcmp(&vertexData[range.first * 4], vertices, range.count * sizeof(vertices[0])) == 0);
+        }
+
+        // date slot is zeroed until the date is uploaded
+        for (int i = table->date.first * 4; i < (table->date.first + DATE_GLYPHS * 6) * 4; i++)
+            CHECK(vertexData[i] == 0.f);
+    }
+}
+
+static void testLookup()
+{
+    const std::vector<std::string> times = makeTimes(false);
+    TestFont font;
+    MeshTableIndex index;
+    std::vector<float> vertexData;
+    index.reset(times);
+    index.addTable(1.f, font, POSX, POSY, DATE_GLYPHS, vertexData);
+
+    for (int minute = 0; minute < 24 * 60; minute++)
+        CHECK(index.lookup(times[minute].c_str(), minute, 1.f) == index.find(1.f));
+
+    // scale without a table
+    CHECK(index.lookup("13:37", 13 * 60 + 37, 2.f) == NULL);
+    CHECK(index.find(2.f) == NULL);
+
+    // minute out of range
+    CHECK(index.lookup("0:00", -1, 1.f) == NULL);
+    CHECK(index.lookup("0:00", 24 * 60, 1.f) == NULL);
+
+    // string the table was not built with, e.g. after a locale change
+    const std::vector<std::string> twelveHour = makeTimes(true);
+    CHECK(index.lookup(twelveHour[13 * 60 + 37].c_str(), 13 * 60 + 37, 1.f) == NULL);
+    CHECK(index.lookup("13:38", 13 * 60 + 37, 1.f) == NULL);
+
+    // rebuilding for the new locale drops the old tables
+    index.reset(twelveHour);
+    vertexData.clear();
+    CHECK(index.find(1.f) == NULL);
+    CHECK(index.getVertexCount() == 0);
+    index.addTable(1.f, font, POSX, POSY, DATE_GLYPHS, vertexData);
+    CHECK(index.lookup(twelveHour[13 * 60 + 37].c_str(), 13 * 60 + 37, 1.f) != NULL);
+    CHECK(index.lookup(times[13 * 60 + 37].c_str(), 13 * 60 + 37, 1.f) == NULL);
+}
+
+int main()
+{
+    testRanges();
+    testMeshesMatchLayout();
+    testLookup();
+
+    if (failures)
+        printf("%d checks failed\n", failures);
+    return failures ? 1 : 0;
+}
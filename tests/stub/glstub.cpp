@@ -0,0 +1,243 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#include "glad/glad.h"
+#include "glstub.h"
+
+#include <map>
+#include <set>
+#include <stdint.h>
+#include <string.h>
+
+namespace
+{
+    GLStubStats stats = {};
+    GLuint nextName = 1;
+
+    std::map<GLuint, std::vector<uint8_t>> buffers;
+    // buffer bound to attribute 0 of each vertex array
+    std::map<GLuint, GLuint> vertexArrays;
+    std::set<GLuint> shaders, programs;
+
+    GLuint boundBuffer = 0, boundVertexArray = 0;
+
+    std::vector<float> drawnVertices;
+
+    int liveObjects()
+    {
+        return (int)(buffers.size() + vertexArrays.size() + shaders.size() + programs.size());
+    }
+
+    // the bound buffer if it exists, NULL otherwise
+    std::vector<uint8_t>* getBoundBuffer()
+    {
+        auto buffer = buffers.find(boundBuffer);
+        if (buffer == buffers.end())
+        {
+            stats.errors++;
+            return NULL;
+        }
+        return &buffer->second;
+    }
+
+    void draw(GLint first, GLsizei count)
+    {
+        auto vertexArray = vertexArrays.find(boundVertexArray);
+        auto buffer = vertexArray != vertexArrays.end() ? buffers.find(vertexArray->second) : buffers.end();
+        if (buffer == buffers.end() || first < 0 || count < 0 ||
+            (size_t)(first + count) * 4 * sizeof(float) > buffer->second.size())
+        {
+            stats.errors++;
+            return;
+        }
+
+        const float* vertices = (const float*)buffer->second.data() + first * 4;
+        drawnVertices.insert(drawnVertices.end(), vertices, vertices + count * 4);
+    }
+}
+
+GLStubStats glStubGetStats()
+{
+    GLStubStats result = stats;
+    result.liveObjects = liveObjects();
+    return result;
+}
+
+const std::vector<float>& glStubGetDrawnVertices()
+{
+    return drawnVertices;
+}
+
+void glStubClearDrawnVertices()
+{
+    drawnVertices.clear();
+}
+
+void glActiveTexture(GLenum texture) { stats.calls++; }
+void glAttachShader(GLuint program, GLuint shader) { stats.calls++; }
+void glBindTexture(GLenum target, GLuint texture) { stats.calls++; }
+void glBlendFunc(GLenum sfactor, GLenum dfactor) { stats.calls++; }
+void glClear(GLbitfield mask) { stats.calls++; }
+void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { stats.calls++; }
+void glCompileShader(GLuint shader) { stats.calls++; }
+void glEnable(GLenum cap) { stats.calls++; }
+void glEnableVertexAttribArray(GLuint index) { stats.calls++; }
+void glFlush() { stats.calls++; }
+GLint glGetUniformLocation(GLuint program, const GLchar* name) { stats.calls++; return 0; }
+void glLinkProgram(GLuint program) { stats.calls++; }
+void glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) { stats.calls++; }
+void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) { stats.calls++; }
+
+void glBindBuffer(GLenum target, GLuint buffer)
+{
+    stats.calls++;
+    if (buffer && !buffers.count(buffer))
+        stats.errors++;
+    boundBuffer = buffer;
+}
+
+void glBindVertexArray(GLuint array)
+{
+    stats.calls++;
+    if (array && !vertexArrays.count(array))
+        stats.errors++;
+    boundVertexArray = array;
+}
+
+void glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+    stats.calls++;
+    stats.bufferWrites++;
+    if (auto buffer = getBoundBuffer())
+    {
+        buffer->assign(size, 0);
+        if (data)
+            memcpy(buffer->data(), data, size);
+    }
+}
+
+void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+    stats.calls++;
+    stats.bufferWrites++;
+    if (auto buffer = getBoundBuffer())
+    {
+        if (offset < 0 || size < 0 || (size_t)(offset + size) > buffer->size())
+            stats.errors++;
+        else
+            memcpy(buffer->data() + offset, data, size);
+    }
+}
+
+GLuint glCreateProgram()
+{
+    stats.calls++;
+    programs.insert(nextName);
+    return nextName++;
+}
+
+GLuint glCreateShader(GLenum type)
+{
+    stats.calls++;
+    shaders.insert(nextName);
+    return nextName++;
+}
+
+void glDeleteBuffers(GLsizei n, const GLuint* names)
+{
+    stats.calls++;
+    for (int i = 0; i < n; i++)
+    {
+        if (!buffers.erase(names[i]))
+            stats.errors++;
+    }
+}
+
+void glDeleteShader(GLuint shader)
+{
+    stats.calls++;
+    if (!shaders.erase(shader))
+        stats.errors++;
+}
+
+void glDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+    stats.calls++;
+    for (int i = 0; i < n; i++)
+    {
+        if (!vertexArrays.erase(arrays[i]))
+            stats.errors++;
+    }
+}
+
+void glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    stats.calls++;
+    stats.drawCalls++;
+    draw(first, count);
+}
+
+void glMultiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount)
+{
+    stats.calls++;
+    stats.drawCalls++;
+    for (int i = 0; i < drawcount; i++)
+        draw(first[i], count[i]);
+}
+
+void glGenBuffers(GLsizei n, GLuint* names)
+{
+    stats.calls++;
+    for (int i = 0; i < n; i++)
+    {
+        buffers[nextName];
+        names[i] = nextName++;
+    }
+}
+
+void glGenVertexArrays(GLsizei n, GLuint* arrays)
+{
+    stats.calls++;
+    for (int i = 0; i < n; i++)
+    {
+        vertexArrays[nextName] = 0;
+        arrays[i] = nextName++;
+    }
+}
+
+void glUseProgram(GLuint program)
+{
+    stats.calls++;
+    if (!programs.count(program))
+        stats.errors++;
+}
+
+void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+{
+    stats.calls++;
+    auto vertexArray = vertexArrays.find(boundVertexArray);
+    if (vertexArray == vertexArrays.end() || !buffers.count(boundBuffer))
+        stats.errors++;
+    else
+        vertexArray->second = boundBuffer;
+}
@@ -0,0 +1,45 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#pragma once
+
+#include <vector>
+
+// counters of the stub GL backend since startup
+struct GLStubStats
+{
+    long long calls;
+    long long drawCalls;
+    // glBufferData and glBufferSubData calls
+    long long bufferWrites;
+    // unknown names, missing bindings and out of range buffer accesses
+    long long errors;
+    // buffers, vertex arrays, shaders and programs not deleted yet
+    int liveObjects;
+};
+
+GLStubStats glStubGetStats();
+
+// vertices (x, y, u, v) drawn since the last call to glStubClearDrawnVertices
+const std::vector<float>& glStubGetDrawnVertices();
+void glStubClearDrawnVertices();
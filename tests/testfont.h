@@ -0,0 +1,53 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#pragma once
+
+#include "fontatlas.h"
+
+// font atlas with synthetic metrics, as FontBitmap needs GDI to rasterize a font
+class TestFont : public FontAtlas
+{
+public:
+    TestFont()
+    {
+        texture = 1;
+        fontHeight = 16;
+        fontAscent = 12;
+        fontDescent = 4;
+        textureWidth = 128;
+        glyphWidth = 9;
+        glyphHeight = 14;
+
+        for (int i = 0; i < NUMCHARS; i++)
+        {
+            glyphs[i].u = (i % 14) * glyphWidth / (float)textureWidth;
+            glyphs[i].v = (i / 14) * glyphHeight / (float)textureWidth;
+            glyphs[i].charWidth = (int8_t)(3 + i % 6);
+            glyphs[i].charHeight = (int8_t)(8 + i % 5);
+            glyphs[i].advance = (int8_t)(5 + i % 4);
+            glyphs[i].xoff = (int8_t)(i % 2);
+            glyphs[i].yoff = (int8_t)(i % 3);
+        }
+    }
+};
@@ -0,0 +1,117 @@
+/*
+Copyright (c) 2021 Arne Rak
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would
+   be appreciated but is not required.
+
+2. Altered source versions must be plainly marked as such, and must not
+   be misrepresented as being the original software.
+
+3. This notice may not be removed or altered from any source
+   distribution.
+*/
+
+#pragma once
+
+#include "clockticker.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+static const int64_t MINUTE = 60 * 1000;
+static const int64_t HOUR = 60 * MINUTE;
+static const int64_t DAY = 24 * HOUR;
+
+// days since 1970-01-01 of a date in the proleptic gregorian calendar
+inline int64_t daysFromCivil(int y, int m, int d)
+{
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+inline void civilFromDays(int64_t z, int* y, int* m, int* d)
+{
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const int64_t doe = z - era * 146097;
+    const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int64_t mp = (5 * doy + 2) / 153;
+    *d = (int)(doy - (153 * mp + 2) / 5 + 1);
+    *m = (int)(mp < 10 ? mp + 3 : mp - 9);
+    *y = (int)(yoe + era * 400 + (*m <= 2));
+}
+
+// 0 = sunday
+inline int weekday(int64_t days)
+{
+    return (int)((days % 7 + 11) % 7);
+}
+
+inline int64_t lastSunday(int year, int month)
+{
+    const int64_t lastDay = daysFromCivil(year + (month == 12), month % 12 + 1, 1) - 1;
+    return lastDay - weekday(lastDay);
+}
+
+// central european time: switches to summer time on the last sunday of march and
+// back on the last sunday of october, both at 01:00 UTC
+inline bool isSummerTime(int64_t utc)
+{
+    int y, m, d;
+    civilFromDays(utc / DAY, &y, &m, &d);
+    return utc >= lastSunday(y, 3) * DAY + HOUR && utc < lastSunday(y, 10) * DAY + HOUR;
+}
+
+// clock source running on a virtual UTC timestamp in milliseconds
+class VirtualClock : public ClockSource
+{
+public:
+    int64_t utc = 0;
+    bool twelveHour = false;
+
+    ClockTime getLocalTime() override
+    {
+        const int64_t local = utc + (isSummerTime(utc) ? 2 : 1) * HOUR;
+        const int64_t days = local / DAY;
+        const int64_t msOfDay = local % DAY;
+
+        ClockTime t;
+        civilFromDays(days, &t.year, &t.month, &t.day);
+        t.dayOfWeek = weekday(days);
+        t.hour = (int)(msOfDay / HOUR);
+        t.minute = (int)(msOfDay % HOUR / MINUTE);
+        t.second = (int)(msOfDay % MINUTE / 1000);
+        return t;
+    }
+
+    void formatTime(const ClockTime& time, char* buffer, int size) override
+    {
+        if (twelveHour)
+            snprintf(buffer, size, "%d:%02d %s", (time.hour + 11) % 12 + 1, time.minute, time.hour < 12 ? "AM" : "PM");
+        else
+            snprintf(buffer, size, "%02d:%02d", time.hour, time.minute);
+    }
+
+    void formatDate(const ClockTime& time, char* buffer, int size) override
+    {
+        if (twelveHour)
+            snprintf(buffer, size, "%d/%d/%d", time.month, time.day, time.year);
+        else
+            snprintf(buffer, size, "%02d.%02d.%d", time.day, time.month, time.year);
+    }
+};